@@ -4,6 +4,19 @@
 #include <algorithm>
 #include <ctime>
 #include <iomanip>
+#include <fstream>
+#include <string_view>
+#include <array>
+#include <unordered_map>
+#include <thread>
+#include <chrono>
+#include <charconv>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
 
 using namespace std;
 
@@ -17,13 +30,19 @@ public:
 
     // Constructor to initialize Review object
     Review(string username, string comment, int rating) 
-        : username(username), comment(comment), rating(rating) {
+        : username(move(username)), comment(move(comment)), rating(rating) {
         date = getCurrentDate();  // Set current date on creation of the review
     }
 
+    // Constructor for reviews whose date is already known (used by bulk import)
+    Review(string username, string comment, int rating, string date)
+        : username(move(username)), comment(move(comment)), rating(rating), date(move(date)) {}
+
 private:
+    friend class BulkImporter; // Bulk import stamps a whole file with one date
+
     // Get the current date as a string
-    string getCurrentDate() {
+    static string getCurrentDate() {
         time_t now = time(0);
         string date = ctime(&now);
         return date.substr(0, date.length() - 1);  // Remove newline character
@@ -45,8 +64,8 @@ public:
 
     // Constructor to create a Product object
     Product(string name, double price, string category, int quantity, string seller) 
-        : name(name), price(price), category(category), quantity(quantity), 
-          sellerName(seller), averageRating(0.0), onSale(false), salePrice(price) {}
+        : name(move(name)), price(price), category(move(category)), quantity(quantity), 
+          sellerName(move(seller)), averageRating(0.0), onSale(false), salePrice(price) {}
 
     // Method to add a review to the product
     void addReview(const string& username, const string& comment, int rating) {
@@ -66,6 +85,13 @@ public:
         salePrice = price; // Revert sale price back to the original price
     }
 
+    // Append a batch of reviews and update the average rating once
+    void addReviews(vector<Review>&& newReviews) {
+        reviews.insert(reviews.end(), make_move_iterator(newReviews.begin()), make_move_iterator(newReviews.end()));
+        newReviews.clear();
+        updateAverageRating();
+    }
+
 private:
     // Update the average rating of the product based on existing reviews
     void updateAverageRating() {
@@ -82,14 +108,63 @@ private:
 class ProductManager {
 private:
     vector<Product> products; // Container for all products
+    unordered_map<string, size_t> nameIndex; // Product name -> position of its first occurrence
+    size_t indexedCount = 0; // Number of products already covered by nameIndex
+    bool bulkLoading = false; // True between beginBulkLoad() and endBulkLoad()
+
+    // Add every product appended since the last call to the name index
+    void indexNewProducts() {
+        nameIndex.reserve(products.size());
+        for (; indexedCount < products.size(); ++indexedCount) {
+            nameIndex.emplace(products[indexedCount].name, indexedCount); // Keep the first product with a given name
+        }
+    }
 
 public:
     // Method to add a new product to the collection
     void addProduct(const string& name, double price, const string& category, int quantity, const string& seller) {
         products.emplace_back(name, price, category, quantity, seller); // Create and add a new product
+        if (!bulkLoading) {
+            indexNewProducts(); // Index it right away unless a bulk load is in progress
+        }
         cout << "Product '" << name << "' added successfully with " << quantity << " units.\n";
     }
 
+    // Suspend index maintenance while many products are appended
+    void beginBulkLoad() {
+        bulkLoading = true;
+    }
+
+    // Append a batch of already validated products without per-product output
+    void addProducts(vector<Product>&& batch) {
+        if (products.empty()) {
+            products = move(batch); // Take over the batch storage directly
+        } else {
+            products.insert(products.end(), make_move_iterator(batch.begin()), make_move_iterator(batch.end()));
+        }
+        batch.clear();
+        if (!bulkLoading) {
+            indexNewProducts();
+        }
+    }
+
+    // Build the name index once for everything appended during the bulk load
+    void endBulkLoad() {
+        bulkLoading = false;
+        indexNewProducts();
+    }
+
+    // Look up a product by name, returns nullptr if it does not exist
+    Product* findProduct(const string& productName) {
+        auto it = nameIndex.find(productName);
+        return it != nameIndex.end() ? &products[it->second] : nullptr;
+    }
+
+    const Product* findProduct(const string& productName) const {
+        auto it = nameIndex.find(productName);
+        return it != nameIndex.end() ? &products[it->second] : nullptr;
+    }
+
     // Display a list of all available products
     void displayAllProducts() const {
         if (products.empty()) {
@@ -109,11 +184,9 @@ public:
 
     // Display detailed information about a specific product
     void displayProductDetails(const string& productName) const {
-        // Find product by name
-        auto it = find_if(products.begin(), products.end(), 
-            [&productName](const Product& p) { return p.name == productName; });
+        const Product* it = findProduct(productName); // Find product by name
 
-        if (it != products.end()) { // If product was found
+        if (it) { // If product was found
             cout << "\n=== Product Details ===\n";
             cout << "Name: " << it->name << "\n";
             cout << "Category: " << it->category << "\n";
@@ -160,17 +233,16 @@ public:
         }
     }
 
-    // Accessor to get the list of products
-    vector<Product>& getProducts() {
+    // Accessor to get the list of products (read-only so the name index stays in sync)
+    const vector<Product>& getProducts() const {
         return products;
     }
 
     // Update the quantity of a product in stock
     bool updateProductQuantity(const string& productName, int quantityToReduce) {
-        auto it = find_if(products.begin(), products.end(), 
-            [&productName](const Product& p) { return p.name == productName; });
+        Product* it = findProduct(productName);
 
-        if (it != products.end() && it->quantity >= quantityToReduce) {
+        if (it && it->quantity >= quantityToReduce) {
             it->quantity -= quantityToReduce; // Reduce quantity
             return true; // Indicate success
         }
@@ -179,10 +251,9 @@ public:
 
     // Set a product on sale by applying a discount
     void setProductOnSale(const string& productName, double discountPercentage) {
-        auto it = find_if(products.begin(), products.end(), 
-            [&productName](const Product& p) { return p.name == productName; });
+        Product* it = findProduct(productName);
 
-        if (it != products.end()) {
+        if (it) {
             it->setSalePrice(discountPercentage); // Apply sale price calculation
             cout << "Product '" << productName << "' is now on sale with " 
                  << discountPercentage << "% discount!\n";
@@ -191,10 +262,9 @@ public:
 
     // Add a review to a specific product
     void addReviewToProduct(const string& productName, const string& username, const string& comment, int rating) {
-        auto it = find_if(products.begin(), products.end(), 
-            [&productName](const Product& p) { return p.name == productName; });
+        Product* it = findProduct(productName);
 
-        if (it != products.end()) {
+        if (it) {
             it->addReview(username, comment, rating); // Add review to product
             cout << "Review added successfully!\n";
         } else {
@@ -203,6 +273,646 @@ public:
     }
 };
 
+// Class for loading large product and review files into a ProductManager.
+// Files are streamed in fixed-size chunks, each chunk is split into records and the
+// records are parsed in parallel. Fields are sliced out of the chunk buffer as
+// string_views, so text is only copied once, when the Product or Review is built.
+// CSV files use the columns "name,price,category,quantity,seller" for products and
+// "product,username,rating,comment" for reviews (a header row is optional); quoted
+// fields may contain commas, doubled quotes and line breaks.
+// JSONL files (.jsonl/.ndjson) hold one flat object per line using the same names
+// as keys; JSON array files are refused.
+class BulkImporter {
+public:
+    // Summary of a finished import
+    struct Report {
+        size_t rowsRead = 0;     // Non-empty data rows found in the file
+        size_t rowsImported = 0; // Rows that were inserted
+        size_t rowsRejected = 0; // Rows that failed validation
+        double seconds = 0.0;    // Wall-clock time of the import
+        long peakMemoryKB = 0;   // Peak resident memory of the process
+        vector<string> rejects;  // First few reject messages ("line N: reason")
+        string error;            // Set if the file could not be read at all
+    };
+
+    BulkImporter(size_t threadCount = 0, size_t chunkBytes = 8 << 20)
+        : threadCount(threadCount ? threadCount : max(1u, thread::hardware_concurrency())),
+          chunkBytes(max<size_t>(chunkBytes, 4096)) {}
+
+    // Import products, inserting them in one batch per chunk and building the name index at the end
+    Report importProducts(const string& path, ProductManager& productManager) {
+        productManager.beginBulkLoad();
+        Report report = streamFile<Product>(path, "name", parseProductRow,
+            [&productManager](vector<Product>& batch, Report& report, vector<pair<size_t, string>>&) {
+                report.rowsImported += batch.size();
+                productManager.addProducts(move(batch));
+            });
+        productManager.endBulkLoad();
+        return report;
+    }
+
+    // Import reviews for existing products, average ratings are recalculated once at the end
+    Report importReviews(const string& path, ProductManager& productManager) {
+        string date = Review::getCurrentDate(); // One timestamp for the whole import
+        unordered_map<Product*, vector<Review>> pendingReviews; // Attached once the whole file is read
+        Report report = streamFile<ReviewRow>(path, "product", parseReviewRow,
+            [&](vector<ReviewRow>& batch, Report& report, vector<pair<size_t, string>>& rejects) {
+                for (auto& row : batch) {
+                    Product* product = productManager.findProduct(row.product);
+                    if (!product) {
+                        rejects.emplace_back(row.line, "unknown product '" + row.product + "'");
+                        continue;
+                    }
+                    pendingReviews[product].emplace_back(move(row.username), move(row.comment), row.rating, date);
+                    report.rowsImported++;
+                }
+            });
+        for (auto& pending : pendingReviews) {
+            pending.first->addReviews(move(pending.second));
+        }
+        return report;
+    }
+
+    // Print the outcome of an import
+    static void printReport(const string& what, const Report& report) {
+        cout << "\n=== " << what << " Import ===\n";
+        if (!report.error.empty()) {
+            cout << report.error << "\n";
+            return;
+        }
+        ios oldFormat(nullptr);
+        oldFormat.copyfmt(cout); // Restore the caller's number formatting afterwards
+        cout << "Rows read: " << report.rowsRead << "\n";
+        cout << "Rows imported: " << report.rowsImported << "\n";
+        cout << "Rows rejected: " << report.rowsRejected << "\n";
+        cout << "Time: " << fixed << setprecision(2) << report.seconds << " s ("
+             << setprecision(0) << (report.seconds > 0 ? report.rowsRead / report.seconds : 0.0) << " rows/sec)\n";
+        cout << "Peak memory: " << setprecision(1) << report.peakMemoryKB / 1024.0 << " MB\n";
+        cout.copyfmt(oldFormat);
+        if (!report.rejects.empty()) {
+            cout << "Rejected rows:\n";
+            for (const auto& message : report.rejects) {
+                cout << "- " << message << "\n";
+            }
+            if (report.rowsRejected > report.rejects.size()) {
+                cout << "... and " << report.rowsRejected - report.rejects.size() << " more\n";
+            }
+        }
+    }
+
+private:
+    enum class Format { Csv, Json };
+
+    // A field sliced out of a line, unescaped only when it is turned into a string
+    struct Field {
+        enum Escape { None, CsvQuotes, Json };
+        string_view text;
+        Escape escape = None;
+
+        string str() const {
+            if (escape == None) return string(text);
+            string out;
+            out.reserve(text.size());
+            for (size_t i = 0; i < text.size(); ++i) {
+                if (escape == CsvQuotes) {
+                    out += text[i];
+                    if (text[i] == '"') ++i; // Skip the second quote of a doubled pair
+                } else if (text[i] != '\\') {
+                    out += text[i];
+                } else {
+                    char c = text[++i]; // Escapes were validated while parsing
+                    switch (c) {
+                        case 'b': out += '\b'; break;
+                        case 'f': out += '\f'; break;
+                        case 'n': out += '\n'; break;
+                        case 'r': out += '\r'; break;
+                        case 't': out += '\t'; break;
+                        case 'u': {
+                            unsigned code = hexValue(text.substr(i + 1, 4));
+                            i += 4;
+                            if (code >= 0xD800 && code <= 0xDBFF && i + 6 < text.size() &&
+                                text[i + 1] == '\\' && text[i + 2] == 'u') {
+                                unsigned low = hexValue(text.substr(i + 3, 4));
+                                if (low >= 0xDC00 && low <= 0xDFFF) {
+                                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00); // Surrogate pair
+                                    i += 6;
+                                }
+                            }
+                            if (code >= 0xD800 && code <= 0xDFFF) code = 0xFFFD; // Lone surrogate
+                            appendUtf8(out, code);
+                            break;
+                        }
+                        default: out += c; // \" \\ and \/
+                    }
+                }
+            }
+            return out;
+        }
+    };
+
+    // One record of the file and the line it starts on
+    struct Record {
+        string_view text;
+        size_t line;
+    };
+
+    // A parsed review waiting to be attached to its product
+    struct ReviewRow {
+        size_t line;
+        string product;
+        string username;
+        string comment;
+        int rating;
+    };
+
+    static constexpr size_t maxRejectsKept = 20;   // Reject messages kept for the report
+    static constexpr size_t minRecordsPerThread = 1024; // Smaller chunks are not worth splitting
+
+    size_t threadCount; // Number of parser threads
+    size_t chunkBytes;  // Bytes read from the file per chunk
+
+    // Stream a file chunk by chunk, parse its records in parallel and hand each batch to insert,
+    // which may add rejects of its own as (line, reason) pairs
+    template <typename Row, typename Parse, typename Insert>
+    Report streamFile(const string& path, string_view headerField, Parse parse, Insert insert) {
+        Report report;
+        auto start = chrono::steady_clock::now();
+        const string jsonArrayError = "JSON array files are not supported, use JSONL (one object per line).";
+        if (extensionOf(path) == "json") {
+            report.error = jsonArrayError;
+            return report;
+        }
+        ifstream in(path, ios::binary);
+        if (!in) {
+            report.error = "Cannot open file '" + path + "'.";
+            return report;
+        }
+        Format format = formatFor(path);
+
+        string chunk;        // Unparsed tail of the previous read followed by the new data
+        size_t lineNo = 0;   // Number of lines already handed out
+        vector<Record> records;
+        while (true) {
+            size_t kept = chunk.size();
+            chunk.resize(kept + chunkBytes);
+            in.read(&chunk[kept], chunkBytes);
+            chunk.resize(kept + static_cast<size_t>(in.gcount()));
+            bool atEnd = !in;
+
+            // Only complete records are parsed, the partial last one waits for the next read
+            size_t end = splitRecords(chunk, format, atEnd, lineNo, records);
+            if (!records.empty() && records[0].line == 1) {
+                Record& first = records[0];
+                if (first.text.substr(0, 3) == "\xEF\xBB\xBF") first.text.remove_prefix(3); // UTF-8 byte order mark
+                if (format == Format::Json && trim(first.text).substr(0, 1) == "[") {
+                    report.error = jsonArrayError;
+                    return report;
+                }
+                if (format == Format::Csv && isHeader(first.text, headerField)) records.erase(records.begin());
+            }
+
+            parseChunk<Row>(records, format, parse, insert, report);
+
+            chunk.erase(0, end);
+            if (atEnd) break;
+        }
+
+        report.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        report.peakMemoryKB = peakMemoryKB();
+        return report;
+    }
+
+    // Parse the records of one chunk on several threads, then insert the results in file order
+    template <typename Row, typename Parse, typename Insert>
+    void parseChunk(const vector<Record>& records, Format format, Parse parse, Insert& insert, Report& report) {
+        size_t workers = min(threadCount, max<size_t>(1, records.size() / minRecordsPerThread));
+        vector<vector<Row>> rows(workers);
+        vector<vector<pair<size_t, string>>> errors(workers);
+        vector<size_t> rowsRead(workers, 0);
+
+        auto work = [&](size_t worker) {
+            size_t begin = records.size() * worker / workers;
+            size_t end = records.size() * (worker + 1) / workers;
+            string error;
+            for (size_t i = begin; i < end; ++i) {
+                rowsRead[worker]++;
+                if (!parse(records[i].text, records[i].line, format, rows[worker], error)) {
+                    errors[worker].emplace_back(records[i].line, move(error));
+                    error.clear();
+                }
+            }
+        };
+
+        vector<thread> pool;
+        for (size_t worker = 1; worker < workers; ++worker) {
+            pool.emplace_back(work, worker);
+        }
+        work(0); // The calling thread takes the first slice
+        for (auto& t : pool) {
+            t.join();
+        }
+
+        for (size_t worker = 0; worker < workers; ++worker) {
+            report.rowsRead += rowsRead[worker];
+            auto& rejects = errors[worker];
+            size_t parseRejects = rejects.size();
+            insert(rows[worker], report, rejects);
+            // Parse and insert rejects are each in line order, merge them so the report is too
+            inplace_merge(rejects.begin(), rejects.begin() + parseRejects, rejects.end(),
+                [](const pair<size_t, string>& a, const pair<size_t, string>& b) { return a.first < b.first; });
+            for (const auto& error : rejects) {
+                reject(report, error.first, error.second);
+            }
+        }
+    }
+
+    // Record a rejected row, keeping only the first few messages
+    static void reject(Report& report, size_t line, const string& reason) {
+        report.rowsRejected++;
+        if (report.rejects.size() < maxRejectsKept) {
+            report.rejects.push_back("line " + to_string(line) + ": " + reason);
+        }
+    }
+
+    // Parse and validate one product row
+    static bool parseProductRow(string_view line, size_t, Format format, vector<Product>& out, string& error) {
+        static constexpr array<string_view, 5> columns = {"name", "price", "category", "quantity", "seller"};
+        array<Field, 5> fields;
+        if (!extractFields(line, format, columns, fields, error)) return false;
+
+        double price;
+        int quantity;
+        string name = fields[0].str();
+        string category = fields[2].str();
+        string seller = fields[4].str();
+        if (name.empty()) {
+            error = "product name is empty";
+        } else if (!toDouble(fields[1].text, price) || price < 0) {
+            error = "invalid price '" + string(fields[1].text) + "'";
+        } else if (category.empty()) {
+            error = "category is empty";
+        } else if (!toInt(fields[3].text, quantity) || quantity < 0) {
+            error = "invalid quantity '" + string(fields[3].text) + "'";
+        } else if (seller.empty()) {
+            error = "seller name is empty";
+        } else {
+            out.emplace_back(move(name), price, move(category), quantity, move(seller));
+            return true;
+        }
+        return false;
+    }
+
+    // Parse and validate one review row, the product itself is checked on insert
+    static bool parseReviewRow(string_view line, size_t lineNo, Format format, vector<ReviewRow>& out, string& error) {
+        static constexpr array<string_view, 4> columns = {"product", "username", "rating", "comment"};
+        array<Field, 4> fields;
+        if (!extractFields(line, format, columns, fields, error)) return false;
+
+        int rating;
+        string product = fields[0].str();
+        string username = fields[1].str();
+        if (product.empty()) {
+            error = "product name is empty";
+        } else if (username.empty()) {
+            error = "username is empty";
+        } else if (!toInt(fields[2].text, rating) || rating < 1 || rating > 5) {
+            error = "rating must be between 1 and 5, got '" + string(fields[2].text) + "'";
+        } else {
+            out.push_back({lineNo, move(product), move(username), fields[3].str(), rating});
+            return true;
+        }
+        return false;
+    }
+
+    // Pull the named columns out of a CSV record (by position) or JSON object (by key)
+    template <size_t N>
+    static bool extractFields(string_view line, Format format, const array<string_view, N>& columns,
+                              array<Field, N>& fields, string& error) {
+        if (format == Format::Csv) {
+            thread_local vector<Field> values; // Reused between lines on each thread
+            if (!splitCsv(line, values, error)) return false;
+            if (values.size() != N) {
+                error = "expected " + to_string(N) + " fields, found " + to_string(values.size());
+                return false;
+            }
+            copy(values.begin(), values.end(), fields.begin());
+            return true;
+        }
+
+        thread_local vector<pair<string_view, Field>> members;
+        if (!parseJsonObject(line, members, error)) return false;
+        for (size_t i = 0; i < N; ++i) {
+            auto it = find_if(members.begin(), members.end(),
+                [&](const pair<string_view, Field>& member) { return member.first == columns[i]; });
+            if (it == members.end()) {
+                error = "missing \"" + string(columns[i]) + "\"";
+                return false;
+            }
+            fields[i] = it->second;
+        }
+        return true;
+    }
+
+    // Split one CSV record into fields, quoted fields may contain commas and doubled quotes
+    static bool splitCsv(string_view line, vector<Field>& fields, string& error) {
+        fields.clear();
+        size_t i = 0;
+        while (true) {
+            Field field;
+            if (i < line.size() && line[i] == '"') {
+                size_t start = ++i;
+                while (true) {
+                    if (i >= line.size()) {
+                        error = "unterminated quoted field";
+                        return false;
+                    }
+                    if (line[i] == '"') {
+                        if (i + 1 < line.size() && line[i + 1] == '"') {
+                            field.escape = Field::CsvQuotes;
+                            i += 2;
+                            continue;
+                        }
+                        break;
+                    }
+                    ++i;
+                }
+                field.text = line.substr(start, i - start);
+                ++i; // Closing quote
+                if (i < line.size() && line[i] != ',') {
+                    error = "unexpected character after quoted field";
+                    return false;
+                }
+            } else {
+                size_t end = min(line.find(',', i), line.size());
+                field.text = trim(line.substr(i, end - i));
+                if (field.text.find('"') != string_view::npos) {
+                    error = "unexpected quote in unquoted field";
+                    return false;
+                }
+                i = end;
+            }
+            fields.push_back(field);
+            if (i >= line.size()) return true;
+            ++i; // Comma
+        }
+    }
+
+    // Parse a flat JSON object whose values are strings, numbers, booleans or null
+    static bool parseJsonObject(string_view line, vector<pair<string_view, Field>>& members, string& error) {
+        members.clear();
+        size_t i = 0;
+        auto skipSpace = [&]() {
+            while (i < line.size() && isspace(static_cast<unsigned char>(line[i]))) ++i;
+        };
+
+        skipSpace();
+        if (i >= line.size() || line[i] != '{') {
+            error = "expected a JSON object";
+            return false;
+        }
+        ++i;
+        skipSpace();
+        if (i < line.size() && line[i] == '}') {
+            ++i;
+        } else {
+            while (true) {
+                Field key, value;
+                if (!parseJsonString(line, i, key, error)) return false;
+                skipSpace();
+                if (i >= line.size() || line[i] != ':') {
+                    error = "expected ':' after key";
+                    return false;
+                }
+                ++i;
+                skipSpace();
+                if (i < line.size() && line[i] == '"') {
+                    if (!parseJsonString(line, i, value, error)) return false;
+                } else {
+                    size_t start = i;
+                    while (i < line.size() && line[i] != ',' && line[i] != '}' &&
+                           !isspace(static_cast<unsigned char>(line[i]))) ++i;
+                    value.text = line.substr(start, i - start);
+                    if (value.text == "null") {
+                        value.text = string_view(); // null reads as an empty value
+                    } else if (value.text != "true" && value.text != "false" && !isJsonNumber(value.text)) {
+                        error = "unsupported value for \"" + string(key.text) + "\"";
+                        return false;
+                    }
+                }
+                members.emplace_back(key.text, value);
+                skipSpace();
+                if (i < line.size() && line[i] == ',') {
+                    ++i;
+                    skipSpace();
+                    continue;
+                }
+                if (i < line.size() && line[i] == '}') {
+                    ++i;
+                    break;
+                }
+                error = "expected ',' or '}'";
+                return false;
+            }
+        }
+        skipSpace();
+        if (i != line.size()) {
+            error = "unexpected text after JSON object";
+            return false;
+        }
+        return true;
+    }
+
+    // Check a bare token against the JSON number grammar
+    static bool isJsonNumber(string_view text) {
+        size_t i = 0;
+        auto digits = [&]() {
+            size_t start = i;
+            while (i < text.size() && isdigit(static_cast<unsigned char>(text[i]))) ++i;
+            return i > start;
+        };
+        if (i < text.size() && text[i] == '-') ++i;
+        if (i < text.size() && text[i] == '0') {
+            ++i; // No leading zeros
+        } else if (!digits()) {
+            return false;
+        }
+        if (i < text.size() && text[i] == '.') {
+            ++i;
+            if (!digits()) return false;
+        }
+        if (i < text.size() && (text[i] == 'e' || text[i] == 'E')) {
+            ++i;
+            if (i < text.size() && (text[i] == '+' || text[i] == '-')) ++i;
+            if (!digits()) return false;
+        }
+        return i == text.size();
+    }
+
+    // Slice a JSON string starting at line[i] == '"', validating its escapes
+    static bool parseJsonString(string_view line, size_t& i, Field& field, string& error) {
+        if (i >= line.size() || line[i] != '"') {
+            error = "expected a string";
+            return false;
+        }
+        size_t start = ++i;
+        while (i < line.size() && line[i] != '"') {
+            if (line[i] == '\\') {
+                field.escape = Field::Json;
+                if (++i >= line.size()) break;
+                if (line[i] == 'u') {
+                    if (i + 4 >= line.size() || hexValue(line.substr(i + 1, 4)) > 0xFFFF) {
+                        error = "invalid \\u escape";
+                        return false;
+                    }
+                    i += 4;
+                } else if (!strchr("\"\\/bfnrt", line[i])) {
+                    error = "invalid escape sequence";
+                    return false;
+                }
+            }
+            ++i;
+        }
+        if (i >= line.size()) {
+            error = "unterminated string";
+            return false;
+        }
+        field.text = line.substr(start, i - start);
+        ++i; // Closing quote
+        return true;
+    }
+
+    // Split a block of text into non-blank records and return how many bytes they cover.
+    // Line breaks inside quoted CSV fields do not end a record, stray quotes in unquoted
+    // fields are left for splitCsv to reject. Unless atEnd is set, the
+    // trailing incomplete record is left for the next call; lineNo counts the lines consumed.
+    static size_t splitRecords(string_view text, Format format, bool atEnd, size_t& lineNo, vector<Record>& records) {
+        records.clear();
+        const char* stops = format == Format::Csv ? "\"\n" : "\n";
+        size_t start = 0;
+        size_t line = lineNo; // Lines seen so far, including those inside the current record
+        bool inQuotes = false;
+        for (size_t i = text.find_first_of(stops); i != string_view::npos; i = text.find_first_of(stops, i + 1)) {
+            if (text[i] == '"') {
+                if (!inQuotes) {
+                    inQuotes = i == start || text[i - 1] == ','; // Only a quote opening a field starts quoting
+                } else if (i + 1 < text.size() && text[i + 1] == '"') {
+                    ++i; // Doubled quote inside a quoted field
+                } else {
+                    inQuotes = false;
+                }
+                continue;
+            }
+            ++line;
+            if (inQuotes) continue;
+            addRecord(text.substr(start, i - start), lineNo + 1, records);
+            start = i + 1;
+            lineNo = line;
+        }
+        if (atEnd && start < text.size()) {
+            addRecord(text.substr(start), lineNo + 1, records); // Last record without a line break
+            start = text.size();
+            lineNo = line + 1;
+        }
+        return start;
+    }
+
+    static void addRecord(string_view text, size_t line, vector<Record>& records) {
+        if (!text.empty() && text.back() == '\r') text.remove_suffix(1);
+        if (!trim(text).empty()) records.push_back({text, line}); // Skip blank lines
+    }
+
+    // Check whether the first CSV line is a header row
+    static bool isHeader(string_view line, string_view firstColumn) {
+        string_view first = trim(line.substr(0, line.find(',')));
+        if (first.size() >= 2 && first.front() == '"' && first.back() == '"') first = first.substr(1, first.size() - 2);
+        return first.size() == firstColumn.size() &&
+               equal(first.begin(), first.end(), firstColumn.begin(),
+                     [](char a, char b) { return tolower(static_cast<unsigned char>(a)) == b; });
+    }
+
+    static string extensionOf(const string& path) {
+        size_t dot = path.rfind('.');
+        string extension = dot == string::npos ? "" : path.substr(dot + 1);
+        transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+        return extension;
+    }
+
+    static Format formatFor(const string& path) {
+        string extension = extensionOf(path);
+        return extension == "jsonl" || extension == "ndjson" ? Format::Json : Format::Csv;
+    }
+
+    static string_view trim(string_view text) {
+        while (!text.empty() && isspace(static_cast<unsigned char>(text.front()))) text.remove_prefix(1);
+        while (!text.empty() && isspace(static_cast<unsigned char>(text.back()))) text.remove_suffix(1);
+        return text;
+    }
+
+    static bool toInt(string_view text, int& value) {
+        text = trim(text);
+        auto result = from_chars(text.data(), text.data() + text.size(), value);
+        return !text.empty() && result.ec == errc() && result.ptr == text.data() + text.size();
+    }
+
+    static bool toDouble(string_view text, double& value) {
+        text = trim(text);
+        char buffer[64];
+        if (text.empty() || text.size() >= sizeof(buffer)) return false;
+        memcpy(buffer, text.data(), text.size()); // strtod needs a terminated string
+        buffer[text.size()] = '\0';
+        char* end;
+        value = strtod(buffer, &end);
+        return end == buffer + text.size() && isfinite(value);
+    }
+
+    // Value of four hex digits, or a value above 0xFFFF if they are not valid
+    static unsigned hexValue(string_view digits) {
+        unsigned value = 0;
+        if (digits.size() != 4) return 0x10000;
+        for (char c : digits) {
+            value <<= 4;
+            if (c >= '0' && c <= '9') value |= c - '0';
+            else if (c >= 'a' && c <= 'f') value |= c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F') value |= c - 'A' + 10;
+            else return 0x10000;
+        }
+        return value;
+    }
+
+    static void appendUtf8(string& out, unsigned code) {
+        if (code < 0x80) {
+            out += static_cast<char>(code);
+        } else if (code < 0x800) {
+            out += static_cast<char>(0xC0 | (code >> 6));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else if (code < 0x10000) {
+            out += static_cast<char>(0xE0 | (code >> 12));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (code >> 18));
+            out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    // Peak resident memory of this process in kilobytes (0 where unavailable)
+    static long peakMemoryKB() {
+#if defined(__unix__) || defined(__APPLE__)
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+        return usage.ru_maxrss / 1024; // Reported in bytes on macOS
+#else
+        return usage.ru_maxrss;
+#endif
+#else
+        return 0;
+#endif
+    }
+};
+
 // Class representing an item in the shopping cart
 class CartItem {
 public:
@@ -402,10 +1112,28 @@ public:
 void displayUserMenu(User* user, ProductManager& productManager);
 
 // Main function
-int main() {
+int main(int argc, char* argv[]) {
     ProductManager productManager; // Instance of the product manager
     UserManager userManager; // Instance of the user manager
 
+    // Seed the catalog from files given as --import-products <file> / --import-reviews <file>
+    BulkImporter importer;
+    for (int i = 1; i < argc; ++i) {
+        string option = argv[i];
+        if ((option == "--import-products" || option == "--import-reviews") && i + 1 < argc) {
+            string path = argv[++i];
+            if (option == "--import-products") {
+                BulkImporter::printReport("Product", importer.importProducts(path, productManager));
+            } else {
+                BulkImporter::printReport("Review", importer.importReviews(path, productManager));
+            }
+        } else {
+            cout << "Unknown option '" << option << "'. Usage: " << argv[0]
+                 << " [--import-products <file>] [--import-reviews <file>]\n";
+            return 1;
+        }
+    }
+
     while (true) {
         cout << "\n=== Mini - Temu ===\n"; // Display application name
         cout << "1. Login\n";
@@ -483,6 +1211,7 @@ void displayUserMenu(User* user, ProductManager& productManager) {
             cout << "3. Set Product on Sale\n";
             cout << "4. View Product Details\n";
             cout << "5. View Inventory\n"; // Added option to view inventory
+            cout << "6. Bulk Import Products/Reviews\n";
             cout << "0. Logout\n";
 
             int choice; // Variable for seller menu choice
@@ -534,6 +1263,27 @@ void displayUserMenu(User* user, ProductManager& productManager) {
                 case 5: // View Inventory option
                     productManager.displayInventory(); // Show inventory details
                     break;
+                case 6: { // Bulk import from a CSV or JSONL file
+                    int kind;
+                    string path;
+                    cout << "Import 1. Products or 2. Reviews: ";
+                    cin >> kind;
+                    if (kind != 1 && kind != 2) {
+                        cout << "Invalid choice. Please enter 1 or 2.\n";
+                        break;
+                    }
+                    cout << "Enter file path (.csv or .jsonl): ";
+                    cin.ignore(); // Clear input buffer
+                    getline(cin, path);
+
+                    BulkImporter importer;
+                    if (kind == 1) {
+                        BulkImporter::printReport("Product", importer.importProducts(path, productManager));
+                    } else {
+                        BulkImporter::printReport("Review", importer.importReviews(path, productManager));
+                    }
+                    break;
+                }
                 default:
                     cout << "Invalid choice. Please try again.\n"; // Prompt for valid choice
             }
@@ -612,12 +1362,10 @@ void displayUserMenu(User* user, ProductManager& productManager) {
                     cin >> quantity;
 
                     // Find the product to add to cart
-                    auto& products = productManager.getProducts();
-                    auto it = find_if(products.begin(), products.end(),
-                        [&productName](const Product& p) { return p.name == productName; });
+                    Product* it = productManager.findProduct(productName);
 
                     // Validate product availability and quantity
-                    if (it != products.end() && it->quantity >= quantity) {
+                    if (it && it->quantity >= quantity) {
                         customer->addToCart(*it, quantity); // Add product to cart
                         productManager.updateProductQuantity(productName, quantity); // Update product quantity
                     } else {